@@ -5,8 +5,15 @@
 #include "mydriver/task_queue.hpp"
 
 namespace MyHttpd::MyDriver {
+    enum class ServerMode : unsigned char {
+        thread_pool, // one blocking acceptor feeding workers which each own a connection at a time
+        reactor,     // epoll event loops which each multiplex many connections
+        uring        // io_uring completion loops which batch accepts, receives & sends
+    };
+
     struct ServerConfig {
         int workers;
+        ServerMode mode;
     };
 
     class ServerDriver {
@@ -16,9 +23,14 @@ namespace MyHttpd::MyDriver {
         [[nodiscard]] bool runService(MySock::ServerSocket socket);
 
     private:
+        [[nodiscard]] bool runThreadPool(MySock::ServerSocket socket);
+        [[nodiscard]] bool runReactors(MySock::ServerSocket socket);
+        [[nodiscard]] bool runUrings(MySock::ServerSocket socket);
+
         MyDriver::TaskQueue m_tasks;
         std::mutex m_cv_mtx;
         std::condition_variable m_task_cv;
         int m_worker_n;
+        ServerMode m_mode;
     };
 }
\ No newline at end of file
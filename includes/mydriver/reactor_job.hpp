@@ -0,0 +1,38 @@
+#pragma once
+
+#include <atomic>
+#include <string_view>
+#include <unordered_map>
+#include "mysock/sockets.hpp"
+#include "mysock/poller.hpp"
+#include "mydriver/worker_job.hpp"
+
+namespace MyHttpd::MyDriver {
+    /**
+     * @brief Event loop for reactor mode: accepts from a shared non-blocking listener and serves each connection as far as its input allows without blocking.
+     * @note Several reactors may share one listener since each registers it exclusively, so only one of them wakes per incoming connection.
+     */
+    class ReactorJob {
+    public:
+        ReactorJob() = delete;
+        ReactorJob(int rid, std::string_view server_name, MySock::ServerSocket& entry_socket);
+
+        [[nodiscard]] int getID() const noexcept;
+        [[nodiscard]] std::size_t getSessionCount() const noexcept;
+
+        void operator()();
+
+        void shutdown() noexcept;
+
+    private:
+        void acceptPending();
+        void serveReady(int fd, Utilities::GMTGen& gmt_utility);
+
+        std::unordered_map<int, WorkerJob> m_sessions;
+        MySock::Poller m_poller;
+        MySock::ServerSocket& m_entry;
+        std::string_view m_server_name;
+        int m_rid;
+        std::atomic_flag m_continue_flag;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <linux/io_uring.h>
+#include "mysock/sockets.hpp"
+#include "mysock/uring.hpp"
+#include "mydriver/worker_job.hpp"
+
+namespace MyHttpd::MyDriver {
+    enum class UringOp : unsigned char {
+        accept = 1,
+        recv,
+        send,
+        provide
+    };
+
+    struct UringSession {
+        WorkerJob worker;
+        std::string outbound; // bytes owned by in-flight sends
+        int pending_sends;
+        bool closing;
+    };
+
+    /**
+     * @brief Completion loop for uring mode: one multishot accept on the shared listener, provided-buffer receives, and linked sends per reply batch.
+     * @note Connections use staged sockets, so the worker states never make socket syscalls themselves.
+     */
+    class UringJob {
+    public:
+        UringJob() = delete;
+        UringJob(int uid, std::string_view server_name, MySock::ServerSocket& entry_socket);
+
+        [[nodiscard]] int getID() const noexcept;
+
+        void operator()();
+
+        void shutdown() noexcept;
+
+    private:
+        [[nodiscard]] bool armAccept();
+        [[nodiscard]] bool armRecv(int fd);
+        [[nodiscard]] bool recycleBuffer(std::uint16_t buffer_id);
+        [[nodiscard]] bool flushOutbound(int fd, UringSession& session);
+
+        void onAccept(const io_uring_cqe& completion);
+        void onRecv(int fd, const io_uring_cqe& completion, Utilities::GMTGen& gmt_utility);
+        void onSend(int fd, const io_uring_cqe& completion);
+        void dropSession(int fd);
+
+        /// @note Declared before the ring so that the kernel's buffer references are gone before this memory is freed.
+        std::unique_ptr<char[]> m_recv_buffers;
+        MySock::UringQueue m_ring;
+        std::unordered_map<int, UringSession> m_sessions;
+        MySock::ServerSocket& m_entry;
+        std::string_view m_server_name;
+        int m_uid;
+        bool m_multishot_accept;
+        std::atomic_flag m_continue_flag;
+    };
+}
\ No newline at end of file
@@ -45,10 +45,23 @@ namespace MyHttpd::MyDriver {
 
         void operator()(TaskQueue& tasks, std::condition_variable& task_cv, std::mutex& cv_mtx);
 
+        /// @note Reactor & uring modes: binds an accepted connection whose input is then pumped by `resumeReady`.
+        void adoptConnection(int fd, MySock::SockIOMode io_mode = MySock::SockIOMode::direct);
+
+        [[nodiscard]] MySock::ClientSocket& viewConnection() noexcept;
+
+        /**
+         * @brief Runs the connection's states for every complete request already received, without waiting for more input.
+         * @return false once the connection is finished and its owner should drop it.
+         */
+        [[nodiscard]] bool resumeReady(Utilities::GMTGen& gmt_utility);
+
     private:
         void transitionAnyway(WorkerState next) noexcept;
         [[nodiscard]] WorkerState transitionWith(WorkerState state, PersistFlag persist) const noexcept;
 
+        void stepConnection(MyHttp::Request& temp_req, MyHttp::Response& temp_res, Utilities::GMTGen& gmt_utility);
+
         void stateTakeTask(TaskQueue& tasks, std::condition_variable& task_cv, std::mutex& cv_mtx);
         [[nodiscard]] MyHttp::Request stateRequest();
         void stateValidate(const MyHttp::Request& temp);
@@ -42,9 +42,8 @@ namespace MyHttpd::MyHttp {
 
     class HttpIntake {
     private:
-        static constexpr auto buffer_size = 1024UL;
-
-        MySock::FixedBuffer<Meta::ASCIIOctet, buffer_size> m_buffer;
+        MySock::BufferView<Meta::ASCIIOctet> m_line_vw;
+        MySock::BufferView<Meta::ASCIIOctet> m_content_vw;
         std::istringstream m_header_stream;
 
         std::unordered_map<std::string, HeaderValue> m_temp_headers;
@@ -53,17 +52,23 @@ namespace MyHttpd::MyHttp {
         HttpSchema m_temp_schema;
 
         ReadState m_state;
+        bool m_awaiting_input;
+
+        /// @note Pauses reading at `current` until more input arrives, since nothing of an incomplete line or body gets consumed.
+        [[nodiscard]] ReadStep awaitInput(ReadState current) noexcept;
 
-        
         [[nodiscard]] ReadStep stateTop(MySock::ClientSocket& sio_stream) noexcept;
         [[nodiscard]] ReadStep stateHeader(MySock::ClientSocket& sio_stream) noexcept;
         [[nodiscard]] ReadStep stateBody() noexcept;
         [[nodiscard]] ReadStep stateTransferNormal(MySock::ClientSocket& sio_stream) noexcept;
         // [[nodiscard]] ReaderMetaData stateTransferChunked(MySock::ClientSocket& sio_stream) noexcept;
         
-        public:
+    public:
         HttpIntake();
-        
+
+        /// @note True after `nextRequest` stopped early for a non-blocking connection, which should then be retried once it's readable.
+        [[nodiscard]] bool isAwaitingInput() const noexcept;
+
         [[nodiscard]] std::optional<Request> nextRequest(MySock::ClientSocket& socket) noexcept;
         void reset();
     };
@@ -23,6 +23,10 @@ namespace MyHttpd::MySock {
             return m_length;
         }
 
+        [[nodiscard]] constexpr const OctetT* getPtr() const noexcept {
+            return m_ptr;
+        }
+
         constexpr bool operator==(std::string_view literal) noexcept {
             if constexpr (not std::is_same_v<OctetT, Meta::ASCIIOctet>) {
                 return false;
@@ -96,4 +100,87 @@ namespace MyHttpd::MySock {
             return {m_data.data() + begin, length};
         }
     };
+
+    /**
+     * @brief Per-connection read-ahead storage: bulk reads land here, then lines and blobs get scanned out of the pending bytes in user space.
+     * @note Views of pending bytes stay valid until the next `compact()`, which a reader only does right before filling more input.
+     */
+    template <typename OctetT, std::size_t Limit> requires (Meta::is_buffer_item_v<OctetT>)
+    class ReadAheadBuffer {
+    private:
+        std::array<OctetT, Limit> m_data;
+        std::size_t m_begin;
+        std::size_t m_length;
+
+    public:
+        static constexpr auto npos = Limit;
+
+        constexpr ReadAheadBuffer() noexcept
+        : m_data {}, m_begin {0UL}, m_length {0UL} {}
+
+        [[nodiscard]] constexpr std::size_t getLimit() const noexcept {
+            return Limit;
+        }
+
+        [[nodiscard]] constexpr std::size_t getPendingLength() const noexcept {
+            return m_length - m_begin;
+        }
+
+        [[nodiscard]] constexpr bool isEmpty() const noexcept {
+            return m_begin == m_length;
+        }
+
+        [[nodiscard]] constexpr bool isFull() const noexcept {
+            return getPendingLength() == Limit;
+        }
+
+        /// @return Offset of `item` from the first pending byte, or `npos` when absent.
+        [[nodiscard]] constexpr std::size_t findPending(OctetT item) const noexcept {
+            const auto pending_begin = m_data.begin() + m_begin;
+            const auto pending_end = m_data.begin() + m_length;
+            const auto item_it = std::find(pending_begin, pending_end, item);
+
+            return (item_it != pending_end) ? static_cast<std::size_t>(item_it - pending_begin) : npos;
+        }
+
+        [[nodiscard]] constexpr BufferView<OctetT> viewPending(std::size_t offset, std::size_t length) const noexcept {
+            if (offset + length > getPendingLength()) {
+                return {};
+            }
+
+            return {m_data.data() + m_begin + offset, length};
+        }
+
+        constexpr void consume(std::size_t n) noexcept {
+            m_begin += std::min(n, getPendingLength());
+
+            if (m_begin == m_length) {
+                m_begin = 0UL;
+                m_length = 0UL;
+            }
+        }
+
+        /// @note Slides the pending bytes to the front so that all free space is contiguous.
+        constexpr void compact() noexcept {
+            if (m_begin == 0UL) {
+                return;
+            }
+
+            std::copy(m_data.begin() + m_begin, m_data.begin() + m_length, m_data.begin());
+            m_length -= m_begin;
+            m_begin = 0UL;
+        }
+
+        [[nodiscard]] inline OctetT* getFreePtr() & noexcept {
+            return m_data.data() + m_length;
+        }
+
+        [[nodiscard]] constexpr std::size_t getFreeLength() const noexcept {
+            return Limit - m_length;
+        }
+
+        constexpr void markFilled(std::size_t filled_n) noexcept {
+            m_length += std::min(filled_n, getFreeLength());
+        }
+    };
 }
\ No newline at end of file
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <sys/epoll.h>
+#include <array>
+#include <span>
+
+namespace MyHttpd::MySock {
+    enum class PollMode : unsigned char {
+        entry_exclusive, // listening socket shared by several pollers: wakes only one of them
+        client_edge      // connection socket: edge-triggered reads
+    };
+
+    /**
+     * @brief Thin RAII wrapper over an epoll instance for readiness-driven connection handling.
+     */
+    class Poller {
+    private:
+        static constexpr auto dud_value = -1;
+        static constexpr auto max_events = 64UL;
+
+        std::array<epoll_event, max_events> m_events;
+        int m_fd;
+
+    public:
+        Poller() noexcept;
+        ~Poller() noexcept;
+
+        Poller(const Poller& other) = delete;
+        Poller& operator=(const Poller& other) = delete;
+        Poller(Poller&& x_other) noexcept;
+        Poller& operator=(Poller&& x_other) noexcept;
+
+        [[nodiscard]] bool isReady() const noexcept;
+
+        [[nodiscard]] bool watch(int fd, PollMode mode) noexcept;
+        void forget(int fd) noexcept;
+
+        /// @note Returns an empty span on timeout or interruption.
+        [[nodiscard]] std::span<const epoll_event> waitEvents(int timeout_ms) noexcept;
+    };
+}
\ No newline at end of file
@@ -3,6 +3,9 @@
 #include <sys/socket.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
+#include <optional>
+#include <string>
+#include <string_view>
 #include "meta/helpers.hpp"
 #include "mysock/buffers.hpp"
 
@@ -17,7 +20,14 @@ namespace MyHttpd::MySock {
         ok,
         closed_pipe,
         invalid_size,
-        exhausted_buffer
+        exhausted_buffer,
+        would_block
+    };
+
+    enum class SockIOMode : unsigned char {
+        direct, // reads & writes are blocking socket syscalls
+        polled, // like `direct`, but reads report `would_block` instead of waiting for input
+        staged  // reads consume bytes staged by an external I/O backend, and writes are staged for it to send
     };
 
     class ServerSocket {
@@ -39,21 +49,36 @@ namespace MyHttpd::MySock {
         ServerSocket& operator=(ServerSocket&& x_other) noexcept;
 
         [[nodiscard]] bool isReady() const noexcept;
+        [[nodiscard]] int getFD() const noexcept;
+
+        /// @note For readiness-driven use: accepting then yields nothing instead of blocking when no connection is pending.
+        [[nodiscard]] SockSetupStatus enableNonBlocking() noexcept;
+
         [[nodiscard]] std::optional<int> acceptConnection() noexcept;
     };
 
     class ClientSocket {
     private:
         static constexpr auto dud_value = -1;
+        static constexpr auto read_ahead_n = 4096UL;
 
+        ReadAheadBuffer<Meta::ASCIIOctet, read_ahead_n> m_inbound;
+        std::string m_staged_out;
         int m_fd;
+        SockIOMode m_mode;
         bool m_closed;
 
         [[maybe_unused]] SockSetupStatus applyOptions(long recv_timeout) noexcept;
 
+        /// @note Reads as much input as fits into the read-ahead buffer with one `recv`.
+        [[nodiscard]] SockIOStatus fillInbound() noexcept;
+
+        /// @note Follows `send` return conventions in either I/O mode.
+        [[nodiscard]] long sendSome(const void* source, std::size_t n) noexcept;
+
     public:
         ClientSocket() noexcept;
-        ClientSocket(int fd, long recv_timeout) noexcept;
+        ClientSocket(int fd, long recv_timeout, SockIOMode mode = SockIOMode::direct) noexcept;
         ~ClientSocket() noexcept;
 
         ClientSocket(const ClientSocket& other) = delete;
@@ -62,72 +87,64 @@ namespace MyHttpd::MySock {
         ClientSocket& operator=(ClientSocket&& x_other) noexcept;
 
         [[nodiscard]] bool isReady() const noexcept;
+        [[nodiscard]] int getFD() const noexcept;
 
-        template <typename OctetT, std::size_t BufferN> requires (Meta::is_buffer_item_v<OctetT>)
-        [[nodiscard]] SockIOStatus readLine(FixedBuffer<OctetT, BufferN>& target, OctetT delim) noexcept {
-            auto residue_space = BufferN;
-            auto read_n = 0UL;
-            OctetT temp = OctetT {};
-            bool found_delim = false;
+        /// @note Input already read ahead but not yet consumed, e.g. the start of a pipelined request.
+        [[nodiscard]] bool hasPendingInput() const noexcept;
 
-            while (not m_closed and residue_space > 0) {
-                auto temp_read_n = recv(m_fd, &temp, 1UL, 0);
+        /// @note Staged mode only: appends bytes which the I/O backend received for this connection, failing if the read-ahead buffer lacks room.
+        [[nodiscard]] bool stageInbound(const char* data, std::size_t n) noexcept;
 
-                if (temp_read_n <= 0) {
-                    m_closed = true;
-                    return SockIOStatus::closed_pipe;
-                }
+        /// @note Staged mode only: hands over all bytes written since the last call for the I/O backend to send.
+        [[nodiscard]] std::string takeOutbound() noexcept;
 
-                if (temp == delim) {
-                    found_delim = true;
-                    break;
-                }
+        /**
+         * @brief Consumes the next line, excluding `delim` and any CR before an LF delimiter.
+         * @note `line` views the read-ahead buffer, so it is only valid until the next read. Nothing is consumed unless the result is `ok`.
+         */
+        [[nodiscard]] SockIOStatus readLine(BufferView<Meta::ASCIIOctet>& line, Meta::ASCIIOctet delim) noexcept;
 
-                if (delim == '\n' and temp == '\r') {
-                    continue;
-                }
+        /**
+         * @brief Consumes the next `blob_size` bytes as a view into the read-ahead buffer.
+         * @note Same validity & consumption rules as the view-based `readLine`.
+         */
+        [[nodiscard]] SockIOStatus readBlob(BufferView<Meta::ASCIIOctet>& blob, std::size_t blob_size) noexcept;
 
-                target.getPtr()[read_n] = temp;
+        template <typename OctetT, std::size_t BufferN> requires (Meta::is_buffer_item_v<OctetT>)
+        [[nodiscard]] SockIOStatus readLine(FixedBuffer<OctetT, BufferN>& target, Meta::ASCIIOctet delim) noexcept {
+            BufferView<Meta::ASCIIOctet> line;
 
-                ++read_n;
-                --residue_space;
+            if (const auto line_status = readLine(line, delim); line_status != SockIOStatus::ok) {
+                return line_status;
             }
 
-            if (not found_delim and residue_space < 1UL) {
+            if (line.length() > BufferN) {
                 target.reset();
                 return SockIOStatus::exhausted_buffer;
             }
 
-            target.markLength(read_n);
+            std::copy(line.getPtr(), line.getPtr() + line.length(), target.getPtr());
+            target.markLength(line.length());
+
             return SockIOStatus::ok;
         }
 
         template <typename OctetT, std::size_t BufferN> requires (Meta::is_buffer_item_v<OctetT>)
         [[nodiscard]] SockIOStatus readBlob(FixedBuffer<OctetT, BufferN>& target, std::size_t blob_size) noexcept {
-            if (blob_size > BufferN) {
+            if (blob_size > BufferN or blob_size > read_ahead_n) {
                 return SockIOStatus::invalid_size;
             }
 
-            auto pending_n = blob_size;
-            auto done_n = 0UL;
-            long temp_n = 0L;
-
-            while (not m_closed and pending_n > 0UL) {
-                temp_n = recv(m_fd, target.getPtr() + done_n, pending_n, 0);
+            BufferView<Meta::ASCIIOctet> blob;
 
-                if (temp_n <= 0) {
-                    m_closed = true;
-                    target.reset();
-
-                    return SockIOStatus::closed_pipe;
-                }
-
-                done_n += temp_n;
-                pending_n -= temp_n;
+            if (const auto blob_status = readBlob(blob, blob_size); blob_status != SockIOStatus::ok) {
+                return blob_status;
             }
 
-            target.markLength(done_n);
-            return (pending_n == 0UL) ? SockIOStatus::ok : SockIOStatus::closed_pipe;
+            std::copy(blob.getPtr(), blob.getPtr() + blob.length(), target.getPtr());
+            target.markLength(blob.length());
+
+            return SockIOStatus::ok;
         }
 
         template <typename OctetT, std::size_t BufferN>
@@ -137,7 +154,7 @@ namespace MyHttpd::MySock {
             auto done_n = 0UL;
 
             while (not m_closed and pending_n > 0UL) {
-                auto temp_n = send(m_fd, source.getPtr() + done_n, pending_n, 0);
+                auto temp_n = sendSome(source.getPtr() + done_n, pending_n);
 
                 if (temp_n <= 0L) {
                     m_closed = true;
@@ -163,7 +180,7 @@ namespace MyHttpd::MySock {
             auto done_n = 0UL;
 
             while (not m_closed and pending_n > 0UL) {
-                auto temp_n = send(m_fd, source.getPtr() + done_n, pending_n, 0);
+                auto temp_n = sendSome(source.getPtr() + done_n, pending_n);
 
                 if (temp_n <= 0L) {
                     m_closed = true;
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <linux/io_uring.h>
+#include <atomic>
+#include <cstdint>
+
+namespace MyHttpd::MySock {
+    /**
+     * @brief Minimal io_uring instance driven by raw syscalls: owns the mapped submission & completion rings.
+     * @note Entries are only prepared by `prep*` calls and then handed to the kernel in one batch by `submitAndWait`.
+     */
+    class UringQueue {
+    private:
+        static constexpr auto dud_value = -1;
+
+        io_uring_sqe* m_sqes;
+        io_uring_cqe* m_cqes;
+        void* m_ring_ptr;
+        std::size_t m_ring_size;
+        unsigned* m_sq_head;
+        unsigned* m_sq_tail;
+        unsigned* m_sq_array;
+        unsigned* m_cq_head;
+        unsigned* m_cq_tail;
+        unsigned m_sq_mask;
+        unsigned m_sq_entries;
+        unsigned m_cq_mask;
+        unsigned m_sq_local_tail;
+        unsigned m_sq_flushed;
+        int m_fd;
+
+        [[nodiscard]] io_uring_sqe* nextEntry() noexcept;
+        [[nodiscard]] int enter(unsigned submit_n, unsigned wait_n, int timeout_ms) noexcept;
+        void unmapRings() noexcept;
+
+    public:
+        UringQueue() noexcept;
+        explicit UringQueue(unsigned entries) noexcept;
+        ~UringQueue() noexcept;
+
+        UringQueue(const UringQueue& other) = delete;
+        UringQueue& operator=(const UringQueue& other) = delete;
+        UringQueue(UringQueue&& x_other) noexcept;
+        UringQueue& operator=(UringQueue&& x_other) noexcept;
+
+        /// @note Probes a throwaway ring for the opcodes & features this backend relies on.
+        [[nodiscard]] static bool isSupported() noexcept;
+
+        [[nodiscard]] bool isReady() const noexcept;
+
+        [[nodiscard]] bool prepAccept(int fd, bool multishot, std::uint64_t tag) noexcept;
+
+        /// @note Lets the kernel pick a buffer of `buffer_group` only once data arrives, so idle connections pin no memory.
+        [[nodiscard]] bool prepRecv(int fd, std::uint16_t buffer_group, std::size_t max_n, std::uint64_t tag) noexcept;
+
+        /// @note A linked send starts only after the previous entry completes, keeping a multi-part reply in order.
+        [[nodiscard]] bool prepSend(int fd, const char* data, std::size_t n, bool linked, std::uint64_t tag) noexcept;
+
+        [[nodiscard]] bool prepProvideBuffers(char* base, std::size_t buffer_n, std::size_t count, std::uint16_t buffer_group, std::uint16_t first_id, std::uint64_t tag) noexcept;
+
+        /// @return Count of entries submitted, or a negative errno value when waiting timed out or failed.
+        int submitAndWait(int timeout_ms) noexcept;
+
+        template <typename CompletionFunc>
+        std::size_t drainCompletions(CompletionFunc&& on_completion) {
+            auto cq_head = *m_cq_head;
+            const auto cq_tail = std::atomic_ref<unsigned> {*m_cq_tail}.load(std::memory_order_acquire);
+            std::size_t done_n = 0UL;
+
+            while (cq_head != cq_tail) {
+                /// @note Copy out first: the callback may prepare entries which would otherwise race with the kernel reusing this slot.
+                const io_uring_cqe completion = m_cqes[cq_head & m_cq_mask];
+
+                ++cq_head;
+                std::atomic_ref<unsigned> {*m_cq_head}.store(cq_head, std::memory_order_release);
+
+                on_completion(completion);
+                ++done_n;
+            }
+
+            return done_n;
+        }
+    };
+}
\ No newline at end of file
@@ -10,22 +10,47 @@
  */
 
 #include <iostream>
+#include <optional>
+#include <string_view>
 #include "mysock/configure.hpp"
 #include "mydriver/driver.hpp"
 
 constexpr auto minimum_argc = 4;
+constexpr auto mode_argc = 5;
+
+[[nodiscard]] std::optional<MyHttpd::MyDriver::ServerMode> parseServerMode(std::string_view mode_sv) noexcept {
+    using MyHttpd::MyDriver::ServerMode;
+
+    if (mode_sv == "pool") {
+        return ServerMode::thread_pool;
+    } else if (mode_sv == "reactor") {
+        return ServerMode::reactor;
+    } else if (mode_sv == "uring") {
+        return ServerMode::uring;
+    }
+
+    return {};
+}
 
 int main(int argc, char* argv[]) {
     using namespace MyHttpd;
 
     if (argc < minimum_argc) {
-        std::print(std::cerr, "Error: invalid argc of {}\n\tusage: ./myhttpd <port> <workers> <client-timeout>\n", argc);
+        std::print(std::cerr, "Error: invalid argc of {}\n\tusage: ./myhttpd <port> <workers> <client-timeout> [pool | reactor | uring]\n", argc);
         return 1;
     }
 
     auto socket_gen = MySock::SocketGenerator::makeSelf(argv[1]);
     const auto worker_count = std::stoi(argv[2]);
     const long client_timeout = std::stol(argv[3]);
+    const auto server_mode = (argc >= mode_argc)
+        ? parseServerMode(argv[4])
+        : MyDriver::ServerMode::thread_pool;
+
+    if (not server_mode.has_value()) {
+        std::print(std::cerr, "Error: unknown server mode '{}', expected 'pool', 'reactor' or 'uring'\n", argv[4]);
+        return 1;
+    }
 
     auto make_socket = [&socket_gen] [[nodiscard]] (long io_timeout) {
         while (socket_gen) {
@@ -39,7 +64,7 @@ int main(int argc, char* argv[]) {
         return MySock::ServerSocket {};
     };
 
-    MyDriver::ServerDriver app {{worker_count}};
+    MyDriver::ServerDriver app {{worker_count, server_mode.value()}};
 
     if (not app.runService(make_socket(client_timeout))) {
         return 1;
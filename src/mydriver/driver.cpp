@@ -1,24 +1,98 @@
 #include <print>
 #include <iostream>
+#include <memory>
 #include <utility>
 #include <thread>
 #include <vector>
 #include "mydriver/entry_job.hpp"
 #include "mydriver/worker_job.hpp"
+#include "mydriver/reactor_job.hpp"
+#include "mydriver/uring_job.hpp"
 #include "mydriver/driver.hpp"
 
 namespace MyHttpd::MyDriver {
     constexpr std::string_view server_name = "myhttpd/0.1-dev";
     constexpr auto min_worker_n = 1;
 
+    /// @note Blocks until the operator asks for a stop, then runs `on_stop` to wind down the jobs.
+    template <typename StopFunc>
+    static void awaitStopCommand(StopFunc on_stop) {
+        char choice;
+
+        do {
+            std::print("Enter 'y' to stop the server:\n");
+
+            std::cin >> choice;
+        } while (choice != 'y');
+
+        std::print("Stopping, please wait.\n");
+        on_stop();
+    }
+
+    /// @note Runs `worker_n` event loop jobs which all share one non-blocking listener.
+    template <typename LoopJob>
+    [[nodiscard]] static bool runEventLoops(MySock::ServerSocket socket, int worker_n, std::string_view loop_name) {
+        if (socket.enableNonBlocking() != MySock::SockSetupStatus::ok) {
+            return false;
+        }
+
+        std::vector<std::unique_ptr<LoopJob>> loops;
+        std::vector<std::thread> loop_thrds;
+
+        for (auto loop_i = 0; loop_i < worker_n; loop_i++) {
+            loops.emplace_back(std::make_unique<LoopJob>(loop_i, server_name, socket));
+        }
+
+        for (auto& loop : loops) {
+            loop_thrds.emplace_back([&loop, loop_name]() {
+                std::print("[{} LOG]: starting {} {}...\n", server_name, loop_name, loop->getID());
+
+                (*loop)();
+
+                std::print("[{} LOG]: {} {} done.\n", server_name, loop_name, loop->getID());
+            });
+        }
+
+        std::thread user_thrd {[&loops]() {
+            awaitStopCommand([&loops]() {
+                for (auto& loop : loops) {
+                    loop->shutdown();
+                }
+            });
+        }};
+
+        for (auto& thrd : loop_thrds) {
+            thrd.join();
+        }
+
+        user_thrd.join();
+
+        return true;
+    }
+
     ServerDriver::ServerDriver(ServerConfig config)
-    : m_tasks {}, m_cv_mtx {}, m_task_cv {}, m_worker_n {(config.workers >= min_worker_n) ? config.workers : min_worker_n } {}
+    : m_tasks {}, m_cv_mtx {}, m_task_cv {}, m_worker_n {(config.workers >= min_worker_n) ? config.workers : min_worker_n }, m_mode {config.mode} {}
 
     bool ServerDriver::runService(MySock::ServerSocket socket) {
         if (not socket.isReady()) {
             return false;
         }
 
+        if (m_mode == ServerMode::uring) {
+            if (MySock::UringQueue::isSupported()) {
+                return runUrings(std::move(socket));
+            }
+
+            std::print("[{} LOG]: io_uring lacks needed features here, falling back to reactor mode.\n", server_name);
+            return runReactors(std::move(socket));
+        } else if (m_mode == ServerMode::reactor) {
+            return runReactors(std::move(socket));
+        }
+
+        return runThreadPool(std::move(socket));
+    }
+
+    bool ServerDriver::runThreadPool(MySock::ServerSocket socket) {
         MyDriver::EntryJob entry {std::move(socket), m_worker_n};
         std::vector<std::thread> worker_thrds;
 
@@ -41,17 +115,10 @@ namespace MyHttpd::MyDriver {
             });
         }
 
-        std::thread user_thrd {[&]() {
-            char choice;
-
-            do {
-                std::print("Enter 'y' to stop the server:\n");
-
-                std::cin >> choice;
-            } while (choice != 'y');
-
-            std::print("Stopping, please wait.\n");
-            entry.shutdown();
+        std::thread user_thrd {[&entry]() {
+            awaitStopCommand([&entry]() {
+                entry.shutdown();
+            });
         }};
 
         entry_thrd.join();
@@ -64,4 +131,12 @@ namespace MyHttpd::MyDriver {
 
         return true;
     }
+
+    bool ServerDriver::runReactors(MySock::ServerSocket socket) {
+        return runEventLoops<MyDriver::ReactorJob>(std::move(socket), m_worker_n, "reactor");
+    }
+
+    bool ServerDriver::runUrings(MySock::ServerSocket socket) {
+        return runEventLoops<MyDriver::UringJob>(std::move(socket), m_worker_n, "uring");
+    }
 }
\ No newline at end of file
@@ -0,0 +1,77 @@
+#include <print>
+#include <utility>
+#include "mydriver/reactor_job.hpp"
+
+namespace MyHttpd::MyDriver {
+    constexpr auto reactor_wait_timeout_ms = 1000;
+
+    ReactorJob::ReactorJob(int rid, std::string_view server_name, MySock::ServerSocket& entry_socket)
+    : m_sessions {}, m_poller {}, m_entry {entry_socket}, m_server_name {server_name}, m_rid {rid}, m_continue_flag {true} {}
+
+    int ReactorJob::getID() const noexcept {
+        return m_rid;
+    }
+
+    std::size_t ReactorJob::getSessionCount() const noexcept {
+        return m_sessions.size();
+    }
+
+    void ReactorJob::operator()() {
+        if (not m_poller.isReady() or not m_poller.watch(m_entry.getFD(), MySock::PollMode::entry_exclusive)) {
+            std::print("[{} LOG]: reactor {} could not watch the entry socket.\n", m_server_name, m_rid);
+            return;
+        }
+
+        Utilities::GMTGen date_gen;
+        const auto entry_fd = m_entry.getFD();
+
+        while (m_continue_flag.test()) {
+            for (const auto& event : m_poller.waitEvents(reactor_wait_timeout_ms)) {
+                if (event.data.fd == entry_fd) {
+                    acceptPending();
+                } else {
+                    serveReady(event.data.fd, date_gen);
+                }
+            }
+        }
+
+        m_poller.forget(entry_fd);
+        m_sessions.clear();
+    }
+
+    void ReactorJob::shutdown() noexcept {
+        m_continue_flag.clear();
+    }
+
+    void ReactorJob::acceptPending() {
+        while (true) {
+            auto incoming_opt = m_entry.acceptConnection();
+
+            if (not incoming_opt.has_value()) {
+                break;
+            }
+
+            const auto client_fd = incoming_opt.value();
+            auto& session = m_sessions.try_emplace(client_fd, m_rid, m_server_name).first->second;
+
+            session.adoptConnection(client_fd, MySock::SockIOMode::polled);
+
+            if (not m_poller.watch(client_fd, MySock::PollMode::client_edge)) {
+                m_sessions.erase(client_fd);
+            }
+        }
+    }
+
+    void ReactorJob::serveReady(int fd, Utilities::GMTGen& gmt_utility) {
+        auto session_it = m_sessions.find(fd);
+
+        if (session_it == m_sessions.end()) {
+            return;
+        }
+
+        if (not session_it->second.resumeReady(gmt_utility)) {
+            /// @note Closing the connection's last descriptor also removes it from the epoll set.
+            m_sessions.erase(session_it);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,216 @@
+#include <algorithm>
+#include <cerrno>
+#include <print>
+#include <utility>
+#include "mydriver/uring_job.hpp"
+
+namespace MyHttpd::MyDriver {
+    constexpr unsigned uring_entries = 256U;
+    constexpr auto uring_wait_timeout_ms = 1000;
+    constexpr std::uint16_t recv_buffer_group = 1U;
+    constexpr auto recv_buffer_n = 2048UL;
+    constexpr auto recv_buffer_count = 256UL;
+    constexpr auto send_chunk_n = 16384UL;
+    constexpr auto tag_op_shift = 32U;
+
+    [[nodiscard]] static constexpr std::uint64_t makeTag(UringOp op, int fd) noexcept {
+        return (static_cast<std::uint64_t>(op) << tag_op_shift) | static_cast<std::uint32_t>(fd);
+    }
+
+    [[nodiscard]] static constexpr UringOp tagToOp(std::uint64_t tag) noexcept {
+        return static_cast<UringOp>(tag >> tag_op_shift);
+    }
+
+    [[nodiscard]] static constexpr int tagToFD(std::uint64_t tag) noexcept {
+        return static_cast<int>(static_cast<std::uint32_t>(tag));
+    }
+
+    UringJob::UringJob(int uid, std::string_view server_name, MySock::ServerSocket& entry_socket)
+    : m_recv_buffers {std::make_unique<char[]>(recv_buffer_n * recv_buffer_count)}, m_ring {uring_entries}, m_sessions {}, m_entry {entry_socket}, m_server_name {server_name}, m_uid {uid}, m_multishot_accept {true}, m_continue_flag {true} {}
+
+    int UringJob::getID() const noexcept {
+        return m_uid;
+    }
+
+    void UringJob::operator()() {
+        if (not m_ring.isReady()) {
+            std::print("[{} LOG]: uring {} could not set up its ring.\n", m_server_name, m_uid);
+            return;
+        }
+
+        if (not m_ring.prepProvideBuffers(m_recv_buffers.get(), recv_buffer_n, recv_buffer_count, recv_buffer_group, 0U, makeTag(UringOp::provide, 0)) or not armAccept()) {
+            std::print("[{} LOG]: uring {} could not queue its first operations.\n", m_server_name, m_uid);
+            return;
+        }
+
+        Utilities::GMTGen date_gen;
+
+        while (m_continue_flag.test()) {
+            m_ring.submitAndWait(uring_wait_timeout_ms);
+
+            m_ring.drainCompletions([&date_gen, this](const io_uring_cqe& completion) {
+                const auto completion_fd = tagToFD(completion.user_data);
+
+                switch (tagToOp(completion.user_data)) {
+                case UringOp::accept:
+                    onAccept(completion);
+                    break;
+                case UringOp::recv:
+                    onRecv(completion_fd, completion, date_gen);
+                    break;
+                case UringOp::send:
+                    onSend(completion_fd, completion);
+                    break;
+                case UringOp::provide:
+                default:
+                    if (completion.res < 0) {
+                        std::print("[{} LOG]: uring {} failed to provide buffers, errno {}.\n", m_server_name, m_uid, -completion.res);
+                    }
+                    break;
+                }
+            });
+        }
+
+        m_sessions.clear();
+    }
+
+    void UringJob::shutdown() noexcept {
+        m_continue_flag.clear();
+    }
+
+    bool UringJob::armAccept() {
+        return m_ring.prepAccept(m_entry.getFD(), m_multishot_accept, makeTag(UringOp::accept, m_entry.getFD()));
+    }
+
+    bool UringJob::armRecv(int fd) {
+        return m_ring.prepRecv(fd, recv_buffer_group, recv_buffer_n, makeTag(UringOp::recv, fd));
+    }
+
+    bool UringJob::recycleBuffer(std::uint16_t buffer_id) {
+        return m_ring.prepProvideBuffers(m_recv_buffers.get() + buffer_id * recv_buffer_n, recv_buffer_n, 1UL, recv_buffer_group, buffer_id, makeTag(UringOp::provide, 0));
+    }
+
+    bool UringJob::flushOutbound(int fd, UringSession& session) {
+        session.outbound = session.worker.viewConnection().takeOutbound();
+
+        const auto outbound_n = session.outbound.length();
+
+        if (outbound_n == 0UL) {
+            return false;
+        }
+
+        /// @note Linking keeps the chunks in order, and a failed chunk cancels the rest so the connection just gets dropped.
+        for (auto chunk_begin = 0UL; chunk_begin < outbound_n; chunk_begin += send_chunk_n) {
+            const auto chunk_n = std::min(send_chunk_n, outbound_n - chunk_begin);
+            const auto is_last = chunk_begin + chunk_n >= outbound_n;
+
+            if (not m_ring.prepSend(fd, session.outbound.data() + chunk_begin, chunk_n, not is_last, makeTag(UringOp::send, fd))) {
+                session.closing = true;
+                break;
+            }
+
+            ++session.pending_sends;
+        }
+
+        return session.pending_sends > 0;
+    }
+
+    void UringJob::onAccept(const io_uring_cqe& completion) {
+        if (completion.res == -EINVAL and m_multishot_accept) {
+            std::print("[{} LOG]: uring {} falling back to single-shot accepts.\n", m_server_name, m_uid);
+            m_multishot_accept = false;
+        } else if (completion.res >= 0) {
+            const auto client_fd = completion.res;
+            auto& session = m_sessions.try_emplace(client_fd, UringSession {
+                .worker = WorkerJob {m_uid, m_server_name},
+                .outbound = {},
+                .pending_sends = 0,
+                .closing = false
+            }).first->second;
+
+            session.worker.adoptConnection(client_fd, MySock::SockIOMode::staged);
+
+            if (not armRecv(client_fd)) {
+                dropSession(client_fd);
+            }
+        }
+
+        /// @note A multishot accept stays armed for as long as the kernel reports more completions to come.
+        if ((completion.flags & IORING_CQE_F_MORE) == 0U and m_continue_flag.test() and not armAccept()) {
+            std::print("[{} LOG]: uring {} could not re-arm its accept.\n", m_server_name, m_uid);
+        }
+    }
+
+    void UringJob::onRecv(int fd, const io_uring_cqe& completion, Utilities::GMTGen& gmt_utility) {
+        const auto has_buffer = (completion.flags & IORING_CQE_F_BUFFER) != 0U;
+        const auto buffer_id = static_cast<std::uint16_t>(completion.flags >> IORING_CQE_BUFFER_SHIFT);
+        auto session_it = m_sessions.find(fd);
+
+        auto staged_ok = true;
+
+        if (has_buffer and completion.res > 0 and session_it != m_sessions.end()) {
+            staged_ok = session_it->second.worker.viewConnection().stageInbound(m_recv_buffers.get() + buffer_id * recv_buffer_n, completion.res);
+        }
+
+        if (has_buffer and not recycleBuffer(buffer_id)) {
+            std::print("[{} LOG]: uring {} lost receive buffer {}.\n", m_server_name, m_uid, buffer_id);
+        }
+
+        if (session_it == m_sessions.end()) {
+            return;
+        }
+
+        if (completion.res == -ENOBUFS) {
+            /// @note All buffers were busy: retry once the ones recycled above are back in the group.
+            if (not armRecv(fd)) {
+                dropSession(fd);
+            }
+
+            return;
+        } else if (completion.res <= 0 or not staged_ok) {
+            dropSession(fd);
+            return;
+        }
+
+        auto& session = session_it->second;
+        session.closing = not session.worker.resumeReady(gmt_utility);
+
+        if (flushOutbound(fd, session)) {
+            return;
+        }
+
+        if (session.closing or not armRecv(fd)) {
+            dropSession(fd);
+        }
+    }
+
+    void UringJob::onSend(int fd, const io_uring_cqe& completion) {
+        auto session_it = m_sessions.find(fd);
+
+        if (session_it == m_sessions.end()) {
+            return;
+        }
+
+        auto& session = session_it->second;
+
+        --session.pending_sends;
+
+        if (completion.res < 0) {
+            session.closing = true;
+        }
+
+        if (session.pending_sends > 0) {
+            return;
+        }
+
+        session.outbound.clear();
+
+        if (session.closing or not armRecv(fd)) {
+            dropSession(fd);
+        }
+    }
+
+    void UringJob::dropSession(int fd) {
+        m_sessions.erase(fd);
+    }
+}
\ No newline at end of file
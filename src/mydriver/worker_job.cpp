@@ -26,39 +26,79 @@ namespace MyHttpd::MyDriver {
             case WorkerState::take_task:
                 stateTakeTask(tasks, task_cv, cv_mtx);
                 break;
-            case WorkerState::request:
-                temp_req = stateRequest();
-                break;
-            case WorkerState::validate:
-                stateValidate(temp_req);
-                break;
-            case WorkerState::handle_good:
-                temp_res = stateHandleGood(temp_req, date_gen);
-                break;
-            case WorkerState::handle_bad:
-                temp_res = stateHandleBad(temp_req, date_gen);
-                break;
-            case WorkerState::reply:
-                stateReply(temp_res);
-                break;
-            case WorkerState::reset:
-                stateReset();
-                break;
-            case WorkerState::error:
-                stateError();
-                break;
             case WorkerState::halt:
+                break;
             default:
+                stepConnection(temp_req, temp_res, date_gen);
                 break;
             }
         }
     }
 
+    void WorkerJob::adoptConnection(int fd, MySock::SockIOMode io_mode) {
+        m_connection = {fd, default_connection_timeout, io_mode};
+        m_conn_persist_flag = PersistFlag::unknown;
+        transitionAnyway(WorkerState::request);
+    }
+
+    MySock::ClientSocket& WorkerJob::viewConnection() noexcept {
+        return m_connection;
+    }
+
+    bool WorkerJob::resumeReady(Utilities::GMTGen& gmt_utility) {
+        MyHttp::Request temp_req;
+        MyHttp::Response temp_res;
+
+        while (true) {
+            if (m_state == WorkerState::reset or m_state == WorkerState::take_task) {
+                return false;
+            } else if (m_state == WorkerState::error) {
+                stateError();
+                return false;
+            }
+
+            stepConnection(temp_req, temp_res, gmt_utility);
+
+            /// @note An incomplete request stays buffered in the connection until its next readiness event.
+            if (m_state == WorkerState::request and m_intake.isAwaitingInput()) {
+                return true;
+            }
+        }
+    }
+
 
     void WorkerJob::transitionAnyway(WorkerState next) noexcept {
         m_state = next;
     }
 
+    void WorkerJob::stepConnection(MyHttp::Request& temp_req, MyHttp::Response& temp_res, Utilities::GMTGen& gmt_utility) {
+        switch (m_state) {
+        case WorkerState::request:
+            temp_req = stateRequest();
+            break;
+        case WorkerState::validate:
+            stateValidate(temp_req);
+            break;
+        case WorkerState::handle_good:
+            temp_res = stateHandleGood(temp_req, gmt_utility);
+            break;
+        case WorkerState::handle_bad:
+            temp_res = stateHandleBad(temp_req, gmt_utility);
+            break;
+        case WorkerState::reply:
+            stateReply(temp_res);
+            break;
+        case WorkerState::reset:
+            stateReset();
+            break;
+        case WorkerState::error:
+            stateError();
+            break;
+        default:
+            break;
+        }
+    }
+
     WorkerState WorkerJob::transitionWith(WorkerState state, PersistFlag persist) const noexcept {
         if (state == WorkerState::take_task) {
             return WorkerState::request;
@@ -108,12 +148,14 @@ namespace MyHttpd::MyDriver {
     }
 
     MyHttp::Request WorkerJob::stateRequest() {
-        m_intake.reset();
+        if (not m_intake.isAwaitingInput()) {
+            m_intake.reset();
+        }
 
         auto maybe_req = m_intake.nextRequest(m_connection);
 
         if (not maybe_req.has_value()) {
-            transitionAnyway(WorkerState::error);
+            transitionAnyway((m_intake.isAwaitingInput()) ? WorkerState::request : WorkerState::error);
             return {};
         }
 
@@ -9,19 +9,32 @@ namespace MyHttpd::MyHttp {
     static constexpr auto http_colon = ':';
     static constexpr auto http_lf = '\n';
 
+    [[nodiscard]] static std::string_view viewLine(const MySock::BufferView<Meta::ASCIIOctet>& line) noexcept {
+        return {line.getPtr(), line.length()};
+    }
+
+    ReadStep HttpIntake::awaitInput(ReadState current) noexcept {
+        m_awaiting_input = true;
+
+        return {
+            .next = current,
+            .had_fatal_error = false
+        };
+    }
+
     ReadStep HttpIntake::stateTop(MySock::ClientSocket& sio_stream) noexcept {
-        m_buffer.reset();
+        const auto read_status = sio_stream.readLine(m_line_vw, http_lf);
 
-        const auto read_status = sio_stream.readLine(m_buffer, http_lf);
-    
-        if (read_status != MySock::SockIOStatus::ok) {
+        if (read_status == MySock::SockIOStatus::would_block) {
+            return awaitInput(ReadState::top);
+        } else if (read_status != MySock::SockIOStatus::ok) {
             return {
                 .next = ReadState::error,
                 .had_fatal_error = true
             };
         }
 
-        m_header_stream = std::istringstream {m_buffer.getPtr()};
+        m_header_stream = std::istringstream {std::string {viewLine(m_line_vw)}};
 
         std::string raw_method;
         m_header_stream >> raw_method;
@@ -41,25 +54,25 @@ namespace MyHttpd::MyHttp {
     }
 
     ReadStep HttpIntake::stateHeader(MySock::ClientSocket& sio_stream) noexcept {
-        m_buffer.reset();
+        const auto read_status = sio_stream.readLine(m_line_vw, http_lf);
 
-        const auto read_status = sio_stream.readLine(m_buffer, http_lf);
-
-        if (read_status != MySock::SockIOStatus::ok) {
+        if (read_status == MySock::SockIOStatus::would_block) {
+            return awaitInput(ReadState::header);
+        } else if (read_status != MySock::SockIOStatus::ok) {
             return {
                 .next = ReadState::error,
                 .had_fatal_error = true
             };
         }
 
-        if (m_buffer.getLength() == 0) {
+        if (m_line_vw.length() == 0) {
             return {
                 .next = ReadState::body,
                 .had_fatal_error = false
             };
         }
 
-        m_header_stream = std::istringstream {m_buffer.getPtr()};
+        m_header_stream = std::istringstream {std::string {viewLine(m_line_vw)}};
         std::string raw_key;
         std::string raw_value;
 
@@ -101,14 +114,14 @@ namespace MyHttpd::MyHttp {
     }
 
     ReadStep HttpIntake::stateTransferNormal(MySock::ClientSocket& sio_stream) noexcept {
-        m_buffer.reset();
-
         const auto& content_length_val = m_temp_headers.at("Content-Length");
         const auto content_length = std::get<int>(content_length_val);
 
-        const auto read_status = sio_stream.readBlob(m_buffer, content_length);
+        const auto read_status = sio_stream.readBlob(m_content_vw, content_length);
 
-        if (read_status != MySock::SockIOStatus::ok) {
+        if (read_status == MySock::SockIOStatus::would_block) {
+            return awaitInput(ReadState::transfer_normal);
+        } else if (read_status != MySock::SockIOStatus::ok) {
             return {
                 .next = ReadState::error,
                 .had_fatal_error = true
@@ -122,13 +135,19 @@ namespace MyHttpd::MyHttp {
     }
 
     HttpIntake::HttpIntake()
-    : m_buffer {}, m_header_stream {}, m_temp_headers {}, m_temp_uri {}, m_temp_method {}, m_temp_schema {}, m_state {ReadState::top} {
+    : m_line_vw {}, m_content_vw {}, m_header_stream {}, m_temp_headers {}, m_temp_uri {}, m_temp_method {}, m_temp_schema {}, m_state {ReadState::top}, m_awaiting_input {false} {
         reset();
     }
 
+    bool HttpIntake::isAwaitingInput() const noexcept {
+        return m_awaiting_input;
+    }
+
     void HttpIntake::reset() {
-        m_buffer.reset();
+        m_line_vw = {};
+        m_content_vw = {};
         m_state = ReadState::top;
+        m_awaiting_input = false;
         m_temp_headers.clear();
         m_temp_headers["Content-Type"] = "*/*";
         m_temp_headers["Content-Length"] = 0;
@@ -141,7 +160,13 @@ namespace MyHttpd::MyHttp {
         ReadStep step;
         bool had_fatal_error = false;
 
+        m_awaiting_input = false;
+
         while (m_state != ReadState::done) {
+            if (m_awaiting_input) {
+                return {};
+            }
+
             // std::cout << "HttpIntake::nextRequest: m_state=" << static_cast<int>(m_state) << '\n';
             switch (m_state) {
             case ReadState::top:
@@ -180,13 +205,13 @@ namespace MyHttpd::MyHttp {
             }
         }
 
-        /// @note The buffer should only have the body content remaining as a buffer-view because the reading will end at the payload.
+        /// @note The body views the connection's read-ahead buffer, so it's only valid until the connection is read from again.
         return {
             Request {
                 m_temp_method,
                 m_temp_schema,
                 m_temp_uri,
-                m_buffer.makeView(0, m_buffer.getLength()),
+                m_content_vw,
                 m_temp_headers
             }
         };
@@ -0,0 +1,62 @@
+#include <unistd.h>
+#include <utility>
+#include "mysock/poller.hpp"
+
+namespace MyHttpd::MySock {
+    static constexpr std::uint32_t entry_exclusive_flags = EPOLLIN | EPOLLEXCLUSIVE;
+    static constexpr std::uint32_t client_edge_flags = EPOLLIN | EPOLLRDHUP | EPOLLET;
+
+    Poller::Poller() noexcept
+    : m_events {}, m_fd {epoll_create1(EPOLL_CLOEXEC)} {}
+
+    Poller::~Poller() noexcept {
+        if (m_fd != dud_value) {
+            close(m_fd);
+            m_fd = dud_value;
+        }
+    }
+
+    Poller::Poller(Poller&& x_other) noexcept
+    : m_events {}, m_fd {std::exchange(x_other.m_fd, dud_value)} {}
+
+    Poller& Poller::operator=(Poller&& x_other) noexcept {
+        if (&x_other == this) {
+            return *this;
+        }
+
+        if (m_fd != dud_value) {
+            close(m_fd);
+        }
+
+        m_fd = std::exchange(x_other.m_fd, dud_value);
+
+        return *this;
+    }
+
+    bool Poller::isReady() const noexcept {
+        return m_fd != dud_value;
+    }
+
+    bool Poller::watch(int fd, PollMode mode) noexcept {
+        epoll_event interest {
+            .events = (mode == PollMode::entry_exclusive) ? entry_exclusive_flags : client_edge_flags,
+            .data = {.fd = fd}
+        };
+
+        return epoll_ctl(m_fd, EPOLL_CTL_ADD, fd, &interest) != dud_value;
+    }
+
+    void Poller::forget(int fd) noexcept {
+        epoll_ctl(m_fd, EPOLL_CTL_DEL, fd, nullptr);
+    }
+
+    std::span<const epoll_event> Poller::waitEvents(int timeout_ms) noexcept {
+        const auto ready_n = epoll_wait(m_fd, m_events.data(), static_cast<int>(max_events), timeout_ms);
+
+        if (ready_n <= 0) {
+            return {};
+        }
+
+        return {m_events.data(), static_cast<std::size_t>(ready_n)};
+    }
+}
\ No newline at end of file
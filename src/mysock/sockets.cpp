@@ -1,4 +1,8 @@
+#include <fcntl.h>
 #include <unistd.h>
+#include <algorithm>
+#include <array>
+#include <cerrno>
 #include <utility>
 #include "mysock/sockets.hpp"
 
@@ -73,6 +77,24 @@ namespace MyHttpd::MySock {
         return m_fd != dud_value;
     }
 
+    int ServerSocket::getFD() const noexcept {
+        return m_fd;
+    }
+
+    SockSetupStatus ServerSocket::enableNonBlocking() noexcept {
+        if (m_fd == dud_value) {
+            return SockSetupStatus::bad_fd;
+        }
+
+        const auto fd_flags = fcntl(m_fd, F_GETFL, 0);
+
+        if (fd_flags == dud_value or fcntl(m_fd, F_SETFL, fd_flags | O_NONBLOCK) == dud_value) {
+            return SockSetupStatus::bad_option;
+        }
+
+        return SockSetupStatus::ok;
+    }
+
     std::optional<int> ServerSocket::acceptConnection() noexcept {
         if (not m_ready) {
             return {};
@@ -105,11 +127,52 @@ namespace MyHttpd::MySock {
         return SockSetupStatus::ok;
     }
 
+    SockIOStatus ClientSocket::fillInbound() noexcept {
+        if (m_closed) {
+            return SockIOStatus::closed_pipe;
+        }
+
+        /// @note Staged input only ever arrives through `stageInbound`, so there is nothing to wait for here.
+        if (m_mode == SockIOMode::staged) {
+            return SockIOStatus::would_block;
+        }
+
+        m_inbound.compact();
+
+        if (m_inbound.getFreeLength() == 0UL) {
+            return SockIOStatus::exhausted_buffer;
+        }
+
+        const auto recv_flags = (m_mode == SockIOMode::polled) ? MSG_DONTWAIT : 0;
+        const auto read_n = recv(m_fd, m_inbound.getFreePtr(), m_inbound.getFreeLength(), recv_flags);
+
+        if (read_n < 0L and m_mode == SockIOMode::polled and (errno == EAGAIN or errno == EWOULDBLOCK)) {
+            return SockIOStatus::would_block;
+        } else if (read_n <= 0L) {
+            m_closed = true;
+            return SockIOStatus::closed_pipe;
+        }
+
+        m_inbound.markFilled(static_cast<std::size_t>(read_n));
+
+        return SockIOStatus::ok;
+    }
+
+    long ClientSocket::sendSome(const void* source, std::size_t n) noexcept {
+        if (m_mode == SockIOMode::direct) {
+            return send(m_fd, source, n, MSG_NOSIGNAL);
+        }
+
+        m_staged_out.append(static_cast<const char*>(source), n);
+
+        return static_cast<long>(n);
+    }
+
     ClientSocket::ClientSocket() noexcept
-    : m_fd {dud_value}, m_closed {true} {}
+    : m_inbound {}, m_staged_out {}, m_fd {dud_value}, m_mode {SockIOMode::direct}, m_closed {true} {}
 
-    ClientSocket::ClientSocket(int fd, long recv_timeout) noexcept
-    : m_fd {fd}, m_closed {false} {
+    ClientSocket::ClientSocket(int fd, long recv_timeout, SockIOMode mode) noexcept
+    : m_inbound {}, m_staged_out {}, m_fd {fd}, m_mode {mode}, m_closed {false} {
         applyOptions(recv_timeout);
     }
 
@@ -121,7 +184,7 @@ namespace MyHttpd::MySock {
     }
 
     ClientSocket::ClientSocket(ClientSocket&& x_other) noexcept
-    : m_fd {dud_value}, m_closed {true} {
+    : m_inbound {x_other.m_inbound}, m_staged_out {std::move(x_other.m_staged_out)}, m_fd {dud_value}, m_mode {x_other.m_mode}, m_closed {true} {
         m_fd = std::exchange(x_other.m_fd, dud_value);
         m_closed = std::exchange(x_other.m_closed, true);
     }
@@ -135,7 +198,10 @@ namespace MyHttpd::MySock {
             close(m_fd);
         }
 
+        m_inbound = x_other.m_inbound;
+        m_staged_out = std::move(x_other.m_staged_out);
         m_fd = std::exchange(x_other.m_fd, dud_value);
+        m_mode = x_other.m_mode;
         m_closed = std::exchange(x_other.m_closed, true);
 
         return *this;
@@ -144,4 +210,73 @@ namespace MyHttpd::MySock {
     bool ClientSocket::isReady() const noexcept {
         return m_fd != dud_value;
     }
+
+    int ClientSocket::getFD() const noexcept {
+        return m_fd;
+    }
+
+    bool ClientSocket::hasPendingInput() const noexcept {
+        return not m_inbound.isEmpty();
+    }
+
+    bool ClientSocket::stageInbound(const char* data, std::size_t n) noexcept {
+        m_inbound.compact();
+
+        if (n > m_inbound.getFreeLength()) {
+            return false;
+        }
+
+        std::copy(data, data + n, m_inbound.getFreePtr());
+        m_inbound.markFilled(n);
+
+        return true;
+    }
+
+    std::string ClientSocket::takeOutbound() noexcept {
+        return std::exchange(m_staged_out, std::string {});
+    }
+
+    SockIOStatus ClientSocket::readLine(BufferView<Meta::ASCIIOctet>& line, Meta::ASCIIOctet delim) noexcept {
+        auto delim_pos = m_inbound.findPending(delim);
+
+        while (delim_pos == m_inbound.npos) {
+            if (m_inbound.isFull()) {
+                return SockIOStatus::exhausted_buffer;
+            }
+
+            if (const auto fill_status = fillInbound(); fill_status != SockIOStatus::ok) {
+                return fill_status;
+            }
+
+            delim_pos = m_inbound.findPending(delim);
+        }
+
+        auto line_n = delim_pos;
+
+        if (delim == '\n' and line_n > 0UL and m_inbound.viewPending(line_n - 1UL, 1UL) == "\r") {
+            --line_n;
+        }
+
+        line = m_inbound.viewPending(0UL, line_n);
+        m_inbound.consume(delim_pos + 1UL);
+
+        return SockIOStatus::ok;
+    }
+
+    SockIOStatus ClientSocket::readBlob(BufferView<Meta::ASCIIOctet>& blob, std::size_t blob_size) noexcept {
+        if (blob_size > m_inbound.getLimit()) {
+            return SockIOStatus::invalid_size;
+        }
+
+        while (m_inbound.getPendingLength() < blob_size) {
+            if (const auto fill_status = fillInbound(); fill_status != SockIOStatus::ok) {
+                return fill_status;
+            }
+        }
+
+        blob = m_inbound.viewPending(0UL, blob_size);
+        m_inbound.consume(blob_size);
+
+        return SockIOStatus::ok;
+    }
 }
\ No newline at end of file
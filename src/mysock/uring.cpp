@@ -0,0 +1,290 @@
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include "mysock/uring.hpp"
+
+namespace MyHttpd::MySock {
+    static constexpr unsigned probe_entries = 4U;
+    static constexpr unsigned probe_op_n = 256U;
+    static constexpr unsigned required_features = IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG;
+    static constexpr std::array<std::uint8_t, 4> required_ops = {
+        IORING_OP_ACCEPT,
+        IORING_OP_RECV,
+        IORING_OP_SEND,
+        IORING_OP_PROVIDE_BUFFERS
+    };
+
+    static int setupRing(unsigned entries, io_uring_params& params) noexcept {
+        return static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    }
+
+    UringQueue::UringQueue() noexcept
+    : m_sqes {nullptr}, m_cqes {nullptr}, m_ring_ptr {nullptr}, m_ring_size {0UL}, m_sq_head {nullptr}, m_sq_tail {nullptr}, m_sq_array {nullptr}, m_cq_head {nullptr}, m_cq_tail {nullptr}, m_sq_mask {0U}, m_sq_entries {0U}, m_cq_mask {0U}, m_sq_local_tail {0U}, m_sq_flushed {0U}, m_fd {dud_value} {}
+
+    UringQueue::UringQueue(unsigned entries) noexcept
+    : UringQueue() {
+        io_uring_params params;
+        std::memset(&params, 0, sizeof(io_uring_params));
+
+        m_fd = setupRing(entries, params);
+
+        if (m_fd == dud_value) {
+            return;
+        }
+
+        /// @note With IORING_FEAT_SINGLE_MMAP both rings share one mapping, sized for the larger of the two.
+        const auto sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        const auto cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        m_ring_size = std::max(sq_ring_size, cq_ring_size);
+
+        m_ring_ptr = mmap(nullptr, m_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_SQ_RING);
+        void* sqes_ptr = mmap(nullptr, params.sq_entries * sizeof(io_uring_sqe), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_SQES);
+
+        if (m_ring_ptr == MAP_FAILED or sqes_ptr == MAP_FAILED) {
+            if (sqes_ptr != MAP_FAILED) {
+                munmap(sqes_ptr, params.sq_entries * sizeof(io_uring_sqe));
+            }
+
+            m_ring_ptr = (m_ring_ptr == MAP_FAILED) ? nullptr : m_ring_ptr;
+            unmapRings();
+            close(m_fd);
+            m_fd = dud_value;
+            return;
+        }
+
+        auto* ring_bytes = static_cast<char*>(m_ring_ptr);
+
+        m_sqes = static_cast<io_uring_sqe*>(sqes_ptr);
+        m_cqes = reinterpret_cast<io_uring_cqe*>(ring_bytes + params.cq_off.cqes);
+        m_sq_head = reinterpret_cast<unsigned*>(ring_bytes + params.sq_off.head);
+        m_sq_tail = reinterpret_cast<unsigned*>(ring_bytes + params.sq_off.tail);
+        m_sq_array = reinterpret_cast<unsigned*>(ring_bytes + params.sq_off.array);
+        m_cq_head = reinterpret_cast<unsigned*>(ring_bytes + params.cq_off.head);
+        m_cq_tail = reinterpret_cast<unsigned*>(ring_bytes + params.cq_off.tail);
+        m_sq_mask = *reinterpret_cast<unsigned*>(ring_bytes + params.sq_off.ring_mask);
+        m_sq_entries = params.sq_entries;
+        m_cq_mask = *reinterpret_cast<unsigned*>(ring_bytes + params.cq_off.ring_mask);
+        m_sq_local_tail = *m_sq_tail;
+        m_sq_flushed = m_sq_local_tail;
+    }
+
+    UringQueue::~UringQueue() noexcept {
+        unmapRings();
+
+        if (m_fd != dud_value) {
+            close(m_fd);
+            m_fd = dud_value;
+        }
+    }
+
+    UringQueue::UringQueue(UringQueue&& x_other) noexcept
+    : UringQueue() {
+        *this = std::move(x_other);
+    }
+
+    UringQueue& UringQueue::operator=(UringQueue&& x_other) noexcept {
+        if (&x_other == this) {
+            return *this;
+        }
+
+        unmapRings();
+
+        if (m_fd != dud_value) {
+            close(m_fd);
+        }
+
+        m_sqes = std::exchange(x_other.m_sqes, nullptr);
+        m_cqes = std::exchange(x_other.m_cqes, nullptr);
+        m_ring_ptr = std::exchange(x_other.m_ring_ptr, nullptr);
+        m_ring_size = std::exchange(x_other.m_ring_size, 0UL);
+        m_sq_head = std::exchange(x_other.m_sq_head, nullptr);
+        m_sq_tail = std::exchange(x_other.m_sq_tail, nullptr);
+        m_sq_array = std::exchange(x_other.m_sq_array, nullptr);
+        m_cq_head = std::exchange(x_other.m_cq_head, nullptr);
+        m_cq_tail = std::exchange(x_other.m_cq_tail, nullptr);
+        m_sq_mask = std::exchange(x_other.m_sq_mask, 0U);
+        m_sq_entries = std::exchange(x_other.m_sq_entries, 0U);
+        m_cq_mask = std::exchange(x_other.m_cq_mask, 0U);
+        m_sq_local_tail = std::exchange(x_other.m_sq_local_tail, 0U);
+        m_sq_flushed = std::exchange(x_other.m_sq_flushed, 0U);
+        m_fd = std::exchange(x_other.m_fd, dud_value);
+
+        return *this;
+    }
+
+    bool UringQueue::isSupported() noexcept {
+        io_uring_params params;
+        std::memset(&params, 0, sizeof(io_uring_params));
+
+        const auto probe_fd = setupRing(probe_entries, params);
+
+        if (probe_fd == dud_value) {
+            return false;
+        }
+
+        const auto probe_size = sizeof(io_uring_probe) + probe_op_n * sizeof(io_uring_probe_op);
+        auto probe_storage = std::make_unique<unsigned char[]>(probe_size);
+        auto* probe = reinterpret_cast<io_uring_probe*>(probe_storage.get());
+
+        const auto probe_status = syscall(__NR_io_uring_register, probe_fd, IORING_REGISTER_PROBE, probe, probe_op_n);
+        close(probe_fd);
+
+        if (probe_status < 0 or (params.features & required_features) != required_features) {
+            return false;
+        }
+
+        return std::all_of(required_ops.begin(), required_ops.end(), [probe](std::uint8_t op) {
+            return op <= probe->last_op and (probe->ops[op].flags & IO_URING_OP_SUPPORTED) != 0;
+        });
+    }
+
+    bool UringQueue::isReady() const noexcept {
+        return m_fd != dud_value;
+    }
+
+    bool UringQueue::prepAccept(int fd, bool multishot, std::uint64_t tag) noexcept {
+        auto* entry = nextEntry();
+
+        if (not entry) {
+            return false;
+        }
+
+        entry->opcode = IORING_OP_ACCEPT;
+        entry->fd = fd;
+        entry->ioprio = (multishot) ? IORING_ACCEPT_MULTISHOT : 0U;
+        entry->user_data = tag;
+
+        return true;
+    }
+
+    bool UringQueue::prepRecv(int fd, std::uint16_t buffer_group, std::size_t max_n, std::uint64_t tag) noexcept {
+        auto* entry = nextEntry();
+
+        if (not entry) {
+            return false;
+        }
+
+        entry->opcode = IORING_OP_RECV;
+        entry->fd = fd;
+        entry->len = static_cast<std::uint32_t>(max_n);
+        entry->flags = IOSQE_BUFFER_SELECT;
+        entry->buf_group = buffer_group;
+        entry->user_data = tag;
+
+        return true;
+    }
+
+    bool UringQueue::prepSend(int fd, const char* data, std::size_t n, bool linked, std::uint64_t tag) noexcept {
+        auto* entry = nextEntry();
+
+        if (not entry) {
+            return false;
+        }
+
+        entry->opcode = IORING_OP_SEND;
+        entry->fd = fd;
+        entry->addr = reinterpret_cast<std::uint64_t>(data);
+        entry->len = static_cast<std::uint32_t>(n);
+        entry->msg_flags = MSG_NOSIGNAL | MSG_WAITALL;
+        entry->flags = (linked) ? IOSQE_IO_LINK : 0U;
+        entry->user_data = tag;
+
+        return true;
+    }
+
+    bool UringQueue::prepProvideBuffers(char* base, std::size_t buffer_n, std::size_t count, std::uint16_t buffer_group, std::uint16_t first_id, std::uint64_t tag) noexcept {
+        auto* entry = nextEntry();
+
+        if (not entry) {
+            return false;
+        }
+
+        entry->opcode = IORING_OP_PROVIDE_BUFFERS;
+        entry->fd = static_cast<int>(count);
+        entry->addr = reinterpret_cast<std::uint64_t>(base);
+        entry->len = static_cast<std::uint32_t>(buffer_n);
+        entry->off = first_id;
+        entry->buf_group = buffer_group;
+        entry->user_data = tag;
+
+        return true;
+    }
+
+    int UringQueue::submitAndWait(int timeout_ms) noexcept {
+        std::atomic_ref<unsigned> {*m_sq_tail}.store(m_sq_local_tail, std::memory_order_release);
+
+        const auto submit_n = m_sq_local_tail - m_sq_flushed;
+        m_sq_flushed = m_sq_local_tail;
+
+        return enter(submit_n, 1U, timeout_ms);
+    }
+
+    io_uring_sqe* UringQueue::nextEntry() noexcept {
+        if (not isReady()) {
+            return nullptr;
+        }
+
+        /// @note A full submission ring gets flushed to the kernel first, without waiting on any completion.
+        if (m_sq_local_tail - std::atomic_ref<unsigned> {*m_sq_head}.load(std::memory_order_acquire) >= m_sq_entries) {
+            std::atomic_ref<unsigned> {*m_sq_tail}.store(m_sq_local_tail, std::memory_order_release);
+
+            if (enter(m_sq_local_tail - m_sq_flushed, 0U, 0) < 0) {
+                return nullptr;
+            }
+
+            m_sq_flushed = m_sq_local_tail;
+
+            if (m_sq_local_tail - std::atomic_ref<unsigned> {*m_sq_head}.load(std::memory_order_acquire) >= m_sq_entries) {
+                return nullptr;
+            }
+        }
+
+        const auto slot = m_sq_local_tail & m_sq_mask;
+        auto* entry = &m_sqes[slot];
+
+        std::memset(entry, 0, sizeof(io_uring_sqe));
+        m_sq_array[slot] = slot;
+        ++m_sq_local_tail;
+
+        return entry;
+    }
+
+    int UringQueue::enter(unsigned submit_n, unsigned wait_n, int timeout_ms) noexcept {
+        __kernel_timespec wait_limit {
+            .tv_sec = timeout_ms / 1000,
+            .tv_nsec = (timeout_ms % 1000) * 1000000L
+        };
+
+        io_uring_getevents_arg wait_args {
+            .sigmask = 0UL,
+            .sigmask_sz = _NSIG / 8,
+            .pad = 0U,
+            .ts = reinterpret_cast<std::uint64_t>(&wait_limit)
+        };
+
+        const auto enter_flags = (wait_n > 0U) ? (IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG) : 0U;
+        const auto enter_status = syscall(__NR_io_uring_enter, m_fd, submit_n, wait_n, enter_flags, &wait_args, sizeof(io_uring_getevents_arg));
+
+        return (enter_status < 0L) ? -errno : static_cast<int>(enter_status);
+    }
+
+    void UringQueue::unmapRings() noexcept {
+        if (m_sqes) {
+            munmap(m_sqes, m_sq_entries * sizeof(io_uring_sqe));
+            m_sqes = nullptr;
+        }
+
+        if (m_ring_ptr) {
+            munmap(m_ring_ptr, m_ring_size);
+            m_ring_ptr = nullptr;
+        }
+    }
+}
\ No newline at end of file